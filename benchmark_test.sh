@@ -21,10 +21,16 @@ declare -A USE_MPI=(
   [v3]=false
   [v4]=true
 )
+declare -A HAS_COMP_INDEX=(
+  [v1]=true
+  [v2]=true
+  [v3]=false
+  [v4]=true
+)
 
 OUTFILE="$PROJECT_ROOT/benchmark_results.csv"
 TABLEFILE="$PROJECT_ROOT/benchmark_table.txt"
-echo "version,graph,time_sec,logfile" > "$OUTFILE"
+echo "version,graph,time_sec,comp_sec,logfile" > "$OUTFILE"
 
 # === RUN BENCHMARKS ===
 for ver in "${VERSIONS[@]}"; do
@@ -50,6 +56,9 @@ for ver in "${VERSIONS[@]}"; do
         cmd=( "$EXE" "$GRAPH_DIR/$g" "$SRC" "$DST" )
       fi
 
+      # drop the cached component index so each version builds its own
+      rm -f "$GRAPH_DIR/$g.comp"
+
       # run & capture all output
       "${cmd[@]}" &> "$LOGFILE"
 
@@ -69,7 +78,14 @@ for ver in "${VERSIONS[@]}"; do
       )
       TIME=${TIME:-NA}
 
-      echo "$ver,$g,$TIME,$ver/$LOGFILE" >> "$OUTFILE"
+      # component index build time from "[Components] ... built in X seconds"
+      COMP=$(awk '/^\[Components\]/ {
+          for(i=1;i<NF;i++) if ($i == "in") { print $(i+1); exit }
+        }' "$LOGFILE"
+      )
+      COMP=${COMP:-NA}
+
+      echo "$ver,$g,$TIME,$COMP,$ver/$LOGFILE" >> "$OUTFILE"
     done
 
   popd >/dev/null
@@ -78,38 +94,39 @@ done
 # === PRINT & SAVE BOXED TABLE ===
 print_boxed_table(){
   local rows=()
-  while IFS=, read -r c1 c2 c3 c4; do
-    rows+=("$c1|$c2|$c3|$c4")
+  while IFS=, read -r c1 c2 c3 c4 c5; do
+    rows+=("$c1|$c2|$c3|$c4|$c5")
   done < "$OUTFILE"
 
   # find max widths
-  local w1=0 w2=0 w3=0 w4=0
+  local w1=0 w2=0 w3=0 w4=0 w5=0
   for row in "${rows[@]}"; do
-    IFS='|' read -r a b c d <<< "$row"
+    IFS='|' read -r a b c d e <<< "$row"
     (( ${#a} > w1 )) && w1=${#a}
     (( ${#b} > w2 )) && w2=${#b}
     (( ${#c} > w3 )) && w3=${#c}
     (( ${#d} > w4 )) && w4=${#d}
+    (( ${#e} > w5 )) && w5=${#e}
   done
 
   # build border
   local border="+"
-  for w in $((w1+2)) $((w2+2)) $((w3+2)) $((w4+2)); do
+  for w in $((w1+2)) $((w2+2)) $((w3+2)) $((w4+2)) $((w5+2)); do
     border+=$(printf '%*s' "$w" '' | tr ' ' -)"+"
   done
 
   # header
   echo "$border"
-  IFS='|' read -r h1 h2 h3 h4 <<< "${rows[0]}"
-  printf "| %-${w1}s | %-${w2}s | %-${w3}s | %-${w4}s |\n" \
-         "$h1" "$h2" "$h3" "$h4"
+  IFS='|' read -r h1 h2 h3 h4 h5 <<< "${rows[0]}"
+  printf "| %-${w1}s | %-${w2}s | %-${w3}s | %-${w4}s | %-${w5}s |\n" \
+         "$h1" "$h2" "$h3" "$h4" "$h5"
   echo "$border"
 
   # data rows
   for ((i=1; i<${#rows[@]}; i++)); do
-    IFS='|' read -r a b c d <<< "${rows[i]}"
-    printf "| %-${w1}s | %-${w2}s | %-${w3}s | %-${w4}s |\n" \
-           "$a" "$b" "$c" "$d"
+    IFS='|' read -r a b c d e <<< "${rows[i]}"
+    printf "| %-${w1}s | %-${w2}s | %-${w3}s | %-${w4}s | %-${w5}s |\n" \
+           "$a" "$b" "$c" "$d" "$e"
   done
   echo "$border"
 }
@@ -122,3 +139,22 @@ echo
 
 # print to both stdout and table file
 print_boxed_table | tee "$TABLEFILE"
+
+# === COMPONENT INDEX SHORT-CIRCUITS ===
+{
+  echo
+  echo "Queries answered by the component index (src/dst in different components):"
+  for ver in "${VERSIONS[@]}"; do
+    if ! ${HAS_COMP_INDEX[$ver]}; then
+      echo "  $ver: n/a (no component index)"
+      continue
+    fi
+    hits=0
+    for g in "${GRAPHS[@]}"; do
+      if grep -q "different components" "$PROJECT_ROOT/$ver/logs/${g%.bin}.log"; then
+        hits=$(( hits + 1 ))
+      fi
+    done
+    echo "  $ver: $hits/${#GRAPHS[@]}"
+  done
+} | tee -a "$TABLEFILE"
@@ -0,0 +1,107 @@
+// components.h
+// Connected-component index that lives next to a graph as "<graph>.bin.comp".
+// Every vertex is labeled with the smallest vertex id in its component, so
+// src and dst are connected iff label[src] == label[dst]. That lets the
+// engines answer unreachable queries without exploring a whole component.
+//
+// File layout (little endian, same as the .bin):
+//   uint32 n, uint32 m, uint64 edge hash, uint32 num_components,
+//   then n uint32 labels
+// The edge hash ties the index to one edge list, so a regenerated graph
+// with the same n and m doesn't reuse a stale index.
+#pragma once
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+static inline std::string compPath(const char* graphFile) {
+    return std::string(graphFile) + ".comp";
+}
+
+// 64-bit FNV-1a over the 2*m words of the flat edge list. Callers hash
+// once and pass the result to both compLoad and compSave.
+static inline uint64_t compHash(const uint32_t* edges, uint32_t m) {
+    uint64_t h = 14695981039346656037ULL;
+    for (uint64_t i = 0; i < 2ULL*m; i++) {
+        h ^= edges[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// identity labels, every vertex in its own component
+static inline void compInit(std::vector<uint32_t>& label, uint32_t n) {
+    label.resize(n);
+    for (uint32_t v = 0; v < n; v++) label[v] = v;
+}
+
+static inline uint32_t compFind(std::vector<uint32_t>& label, uint32_t x) {
+    while (label[x] != x) {
+        label[x] = label[label[x]];  // path halving
+        x = label[x];
+    }
+    return x;
+}
+
+// Union-find over edges first, first+stride, ... of the flat edge list.
+// Roots are always linked under the smaller id, so once flattened each
+// label is the minimum vertex of its set. Starting from any forest where
+// label[v] <= v (identity, or the MIN-merge of several ranks' results)
+// only ever lowers labels, which is what lets MPI ranks each take a
+// slice of the edges and combine with MPI_MIN.
+// Returns true if two roots were linked. Once no rank links anything,
+// every rank flattened to the same labels and the MIN-merge is final.
+static inline bool compUnionEdges(const uint32_t* edges, uint32_t m,
+                                  uint32_t first, uint32_t stride,
+                                  std::vector<uint32_t>& label) {
+    bool linked = false;
+    for (uint32_t e = first; e < m; e += stride) {
+        uint32_t a = compFind(label, edges[2*e]);
+        uint32_t b = compFind(label, edges[2*e+1]);
+        if (a < b) { label[b] = a; linked = true; }
+        else if (b < a) { label[a] = b; linked = true; }
+    }
+    for (uint32_t v = 0; v < (uint32_t)label.size(); v++)
+        label[v] = compFind(label, v);
+    return linked;
+}
+
+static inline uint32_t compCount(const std::vector<uint32_t>& label) {
+    uint32_t k = 0;
+    for (uint32_t v = 0; v < (uint32_t)label.size(); v++)
+        if (label[v] == v) k++;
+    return k;
+}
+
+// false if the index is missing or was built for a different graph
+static inline bool compLoad(const char* graphFile, uint32_t n, uint32_t m,
+                            uint64_t hash,
+                            std::vector<uint32_t>& label, uint32_t& numComp) {
+    std::ifstream in(compPath(graphFile), std::ios::binary);
+    if (!in) return false;
+    uint32_t fn, fm;
+    uint64_t fh;
+    in.read(reinterpret_cast<char*>(&fn), sizeof(fn));
+    in.read(reinterpret_cast<char*>(&fm), sizeof(fm));
+    in.read(reinterpret_cast<char*>(&fh), sizeof(fh));
+    in.read(reinterpret_cast<char*>(&numComp), sizeof(numComp));
+    if (!in || fn != n || fm != m || fh != hash) return false;
+    label.resize(n);
+    in.read(reinterpret_cast<char*>(label.data()), n * sizeof(uint32_t));
+    return (bool)in;
+}
+
+static inline bool compSave(const char* graphFile, uint32_t m,
+                            uint64_t hash,
+                            const std::vector<uint32_t>& label, uint32_t numComp) {
+    std::ofstream out(compPath(graphFile), std::ios::binary);
+    if (!out) return false;
+    uint32_t n = label.size();
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char*>(&m), sizeof(m));
+    out.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+    out.write(reinterpret_cast<const char*>(&numComp), sizeof(numComp));
+    out.write(reinterpret_cast<const char*>(label.data()), n * sizeof(uint32_t));
+    return (bool)out;
+}
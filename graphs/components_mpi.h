@@ -0,0 +1,51 @@
+// components_mpi.h
+// MPI side of components.h, shared by the v2 and v4 engines.
+#pragma once
+#include <mpi.h>
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include "components.h"
+
+// Rank 0 loads the cached index. Otherwise every rank union-finds its
+// strided slice of the edges and the slices are merged with MIN until no
+// rank links two roots in a round; rank 0 then writes the index. Labels
+// are only guaranteed on rank 0, which also prints the [Components] line.
+static inline void compBuildMPI(const char* filename, uint32_t n, uint32_t m,
+                                const std::vector<uint32_t>& flat,
+                                int rank, int size,
+                                std::vector<uint32_t>& label, uint32_t& numComp) {
+    numComp = 0;
+    uint64_t hash = 0;
+    if (rank == 0) hash = compHash(flat.data(), m);
+    double c0 = MPI_Wtime();
+    int cached = 0;
+    if (rank == 0) cached = compLoad(filename, n, m, hash, label, numComp);
+    MPI_Bcast(&cached, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    if (!cached) {
+        compInit(label, n);
+        int linked = 1;
+        while (linked) {
+            int local = compUnionEdges(flat.data(), m, rank, size, label);
+            MPI_Allreduce(MPI_IN_PLACE, label.data(), n,
+                          MPI_UNSIGNED, MPI_MIN, MPI_COMM_WORLD);
+            MPI_Allreduce(&local, &linked, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD);
+        }
+        numComp = compCount(label);
+    }
+    double c1 = MPI_Wtime();
+    if (rank == 0 && !cached && !compSave(filename, m, hash, label, numComp))
+        std::cerr << "Cannot write " << compPath(filename) << "\n";
+    if (rank == 0)
+        std::cout << "[Components] " << numComp << " components, "
+                  << (cached ? "loaded in " : "built in ") << (c1 - c0) << " seconds\n";
+}
+
+// same answer on every rank: are src and dst in one component
+static inline bool compSameMPI(const std::vector<uint32_t>& label,
+                               int src, int dst, int rank) {
+    int same = 0;
+    if (rank == 0) same = label[src] == label[dst];
+    MPI_Bcast(&same, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    return same;
+}
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <chrono>
+#include "../graphs/components.h"
 
 int main(int argc, char* argv[]) {
     if (argc != 4) {
@@ -38,6 +39,25 @@ int main(int argc, char* argv[]) {
         adj[u].push_back(v);
         adj[v].push_back(u);
     }
+
+    // component index: load the cached one or build it with union-find
+    std::vector<uint32_t> label;
+    uint32_t numComp;
+    uint64_t hash = compHash(edges.data(), m);
+    auto c0 = std::chrono::steady_clock::now();
+    bool cached = compLoad(filename, n, m, hash, label, numComp);
+    if (!cached) {
+        compInit(label, n);
+        compUnionEdges(edges.data(), m, 0, 1, label);
+        numComp = compCount(label);
+    }
+    auto c1 = std::chrono::steady_clock::now();
+    if (!cached && !compSave(filename, m, hash, label, numComp))
+        std::cerr << "Cannot write " << compPath(filename) << "\n";
+    std::cout << "[Components] " << numComp << " components, "
+              << (cached ? "loaded in " : "built in ")
+              << std::chrono::duration<double>(c1 - c0).count() << " seconds\n";
+    bool sameComp = label[src] == label[dst];
     std::vector<char> visitedSrc(n, 0), visitedDst(n, 0);
     std::vector<int>  parentSrc(n, -1), parentDst(n, -1);
     std::vector<int>  frontierSrc, frontierDst, nextFrontier;
@@ -47,7 +67,7 @@ int main(int argc, char* argv[]) {
 
     int meet = -1;
     auto t0 = std::chrono::steady_clock::now();
-    while (meet == -1 && !frontierSrc.empty() && !frontierDst.empty()) {
+    while (sameComp && meet == -1 && !frontierSrc.empty() && !frontierDst.empty()) {
         bool expandSrc = frontierSrc.size() <= frontierDst.size();
         nextFrontier.clear();
 
@@ -80,7 +100,10 @@ int main(int argc, char* argv[]) {
         }
     }
     auto t1 = std::chrono::steady_clock::now();
-    if (meet == -1) {
+    if (!sameComp) {
+        std::cout << "No path found between " << src << " and " << dst
+                  << " (different components)\n";
+    } else if (meet == -1) {
         std::cout << "No path found between " << src << " and " << dst << "\n";
     } else {
         std::vector<int> rev1;
@@ -7,6 +7,7 @@
 #include <cstdlib>
 #include <queue>
 #include <algorithm>
+#include "../graphs/components_mpi.h"
 
 static inline int popcnt(uint64_t x) {
     return __builtin_popcountll(x);
@@ -49,6 +50,12 @@ int main(int argc, char* argv[]) {
         adj[v].push_back(u);
     }
 
+    // component index, see graphs/components_mpi.h
+    std::vector<uint32_t> label;
+    uint32_t numComp;
+    compBuildMPI(filename, n, m, flat, rank, size, label, numComp);
+    int sameComp = compSameMPI(label, src, dst, rank);
+
     // init bitsets
     int L = (n+63)>>6;
     std::vector<uint64_t>
@@ -65,7 +72,7 @@ int main(int argc, char* argv[]) {
     bool found = false;
     double t0 = MPI_Wtime();
 
-    while(!found){
+    while(sameComp && !found){
         // expand S
         std::fill(nextS.begin(), nextS.end(), 0ULL);
         for(uint32_t u=rank; u<(uint32_t)n; u+=size){
@@ -130,9 +137,14 @@ int main(int argc, char* argv[]) {
 
     double t1 = MPI_Wtime();
     if(rank==0){
+        if(!sameComp)
+            std::cout<<"No path found between "<<src<<" and "<<dst
+                     <<" (different components)\n";
         if(found)
             std::cout<<"Shortest path length = "<<distance<<"\n";
         std::cout<<"[Time] bidir‑bitset BFS = "<<(t1-t0)<<" seconds\n";
+    }
+    if(rank==0 && sameComp){
         // annoying to recreate
         std::vector<int> parent(n, -1);
         std::queue<int> q;
@@ -7,6 +7,7 @@
 #include <queue>
 #include <cstdlib>
 #include "comp.h"
+#include "../graphs/components_mpi.h"
 
 int main(int argc, char* argv[]){
     MPI_Init(&argc, &argv);
@@ -63,9 +64,17 @@ int main(int argc, char* argv[]){
         adj[v].push_back(u);
     }
 
-    // 3) Initialize GPU
-    cudaInitGraph(N, M, row_ptr.data(), col_ind.data());
-    cudaInitFrontiers(src, dst);
+    // 3) Component index, see graphs/components_mpi.h
+    std::vector<uint32_t> label;
+    uint32_t numComp;
+    compBuildMPI(filename, N, M, flat, rank, size, label, numComp);
+    int sameComp = compSameMPI(label, src, dst, rank);
+
+    // 4) Initialize GPU (not needed when the index already rules out a path)
+    if (sameComp) {
+        cudaInitGraph(N, M, row_ptr.data(), col_ind.data());
+        cudaInitFrontiers(src, dst);
+    }
 
     std::vector<int> front_s(N,0), front_t(N,0), nextF(N,0), vis_s(N,0), vis_t(N,0);
     front_s[src] = vis_s[src] = 1;
@@ -75,8 +84,8 @@ int main(int argc, char* argv[]){
     bool found = false;
     double t0 = MPI_Wtime();
 
-    // 4) BFS loop
-    while (!found) {
+    // 5) BFS loop
+    while (sameComp && !found) {
         // a) local intersect test
         for (int i = 0; i < (int)N; i++) {
             if (vis_s[i] && vis_t[i]) { found = true; break; }
@@ -133,10 +142,14 @@ int main(int argc, char* argv[]){
 
     double t1 = MPI_Wtime();
     if (rank == 0) {
+        if (!sameComp)
+            std::cout << "No path found between " << src << " and " << dst
+                      << " (different components)\n";
         if (found)
             std::cout << "Shortest path length = " << distance << "\n";
         std::cout << "[Time] MPI+CUDA BI‑BFS = " << (t1 - t0) << " s\n";
-
+    }
+    if (rank == 0 && sameComp) {
         // reconstruct path via host BFS
         std::vector<int> parent(N, -1);
         std::queue<int> q;
@@ -164,7 +177,7 @@ int main(int argc, char* argv[]){
         }
     }
 
-    cudaFreeGraph();
+    if (sameComp) cudaFreeGraph();
     MPI_Finalize();
     return 0;
 }